@@ -0,0 +1,23 @@
+
+#  If 'make' isn't run from the root directory, we need to set these to
+#  point to the upper level build directory.
+ifeq "$(strip ${BUILD_DIR})" ""
+  BUILD_DIR    := ../$(OSTYPE)-$(MACHINETYPE)/obj
+endif
+ifeq "$(strip ${TARGET_DIR})" ""
+  TARGET_DIR   := ../$(OSTYPE)-$(MACHINETYPE)
+endif
+
+TARGET   := canu-bench
+SOURCES  := canu-bench.C \
+            ../meryl/merylCountArray.C
+
+SRC_INCDIRS  := .. ../utility ../stores ../meryl ../correction ../overlapInCore/liboverlap ../utgcns/libpbutgcns ../utgcns/libboost
+
+SRC_CXXFLAGS := -DCANU
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -lcanu
+TGT_PREREQS := libcanu.a
+
+SUBMAKEFILES :=
@@ -37,6 +37,9 @@ SOURCES      := AS_global.C \
                 \
                 utility/system.C \
                 utility/system-stackTrace.C \
+                utility/system-largeAlloc.C \
+                utility/system-cpuLevel.C \
+                utility/instrumentation.C \
                 \
                 utility/sequence.C \
                 \
@@ -70,11 +73,13 @@ SOURCES      := AS_global.C \
                 stores/sqStorePartition.C \
                 \
                 stores/ovOverlap.C \
+                stores/ovOverlapImport.C \
                 stores/ovStore.C \
                 stores/ovStoreWriter.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
                 stores/ovStoreHistogram.C \
+                stores/ovStoreScan.C \
                 \
                 stores/tgStore.C \
                 stores/tgTig.C \
@@ -213,10 +218,18 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 fastq-utilities/fastqAnalyze.mk \
                 fastq-utilities/fastqSample.mk \
                 fastq-utilities/fastqSimulate.mk \
-                fastq-utilities/fastqSimulate-sort.mk
+                fastq-utilities/fastqSimulate-sort.mk \
+                \
+                execution/jobRunner.mk
 
 ifeq ($(BUILDTESTS), 1)
 SUBMAKEFILES += utility/bitsTest.mk \
                 utility/filesTest.mk \
-                utility/stddevTest.mk
+                utility/stddevTest.mk \
+                utility/kmersTest.mk \
+                \
+                stores/sqStoreEncodeTest.mk \
+                stores/ovStoreAppendTest.mk \
+                \
+                benchmarks/canu-bench.mk
 endif
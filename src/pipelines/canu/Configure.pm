@@ -593,33 +593,37 @@ sub configureAssembler () {
     #  For uncorrected overlapper, both memory and thread count is reduced.  Memory because it is
     #  very CPU bound, and thread count because it can be quite unbalanced.
 
-    #  22 bits ->   864 MB table structure,   64 million kmers
-    #  23 bits ->  1728 MB table structure,  128 million kmers
-    #  24 bits ->  3456 MB table structure,  256 million kmers
-    #  25 bits ->  6912 MB table structure,  512 million kmers
-    #  26 bits -> 13824 MB table structure, 1024 million kmers
+    #  22 bits ->  1024 MB table structure,   64 million kmers
+    #  23 bits ->  2048 MB table structure,  128 million kmers
+    #  24 bits ->  4096 MB table structure,  256 million kmers
+    #  25 bits ->  8192 MB table structure,  512 million kmers
+    #  26 bits -> 16384 MB table structure, 1024 million kmers
+    #
+    #  (Each bucket is 256 bytes, padded to a multiple of the cache line size.)
     #
     #    sequence generate -min 5000 -max 25000 -bases 10000000000                                   > random.fasta
     #    sequence generate -min 5000 -max 25000 -bases 10000000000 -a 0.9 -c 0.033 -g 0.033 -t 0.033 > repeat.fasta
     #
     #               TABLE    W/DATA
-    #    bits 20   216 MB -  2500 MB random -   16 million kmers at 75% load
-    #    bits 21   432 MB -  2750 MB random -   32 million kmers
+    #    bits 20   256 MB -  2540 MB random -   16 million kmers at 75% load
+    #    bits 21   512 MB -  2830 MB random -   32 million kmers
     #
-    #    bits 22   864 MB -  3000 MB random -   64 million kmers
+    #    bits 22  1024 MB -  3160 MB random -   64 million kmers
     #
-    #    bits 23  1728 MB -  3500 MB random -  128 million kmers
+    #    bits 23  2048 MB -  3820 MB random -  128 million kmers
     #
-    #    bits 24  3456 MB -  5750 MB random -  200 million kmers at 56% load
-    #             3456 MB -  6500 MB random -  256 million kmers at 75% load
-    #             3456 MB -  8200 MB repeat -  256 million kmers at  5% load
+    #    bits 24  4096 MB -  6390 MB random -  200 million kmers at 56% load
+    #             4096 MB -  7140 MB random -  256 million kmers at 75% load
+    #             4096 MB -  8840 MB repeat -  256 million kmers at  5% load
     #
-    #    bits 25  6912 MB - 10000 MB random -  300 million kmers at 42% load
-    #             6912 MB - 12750 MB random -  512 million kmers at 75% load
-    #             6912 MB - 21000 MB repeat -  600 million kmers at  5% load
+    #    bits 25  8192 MB - 11280 MB random -  300 million kmers at 42% load
+    #             8192 MB - 14030 MB random -  512 million kmers at 75% load
+    #             8192 MB - 22280 MB repeat -  600 million kmers at  5% load
     #
-    #    bits 26 13824 MB - 25000 MB random - 1024 million kmers at 75% load
+    #    bits 26 16384 MB - 27560 MB random - 1024 million kmers at 75% load
     #
+    #  Correction overlaps load only corOvlHashBlockLength (2.5 Mbp) of sequence, far less than
+    #  even 22 bits holds, so corOvlHashBits is capped at 24 to leave room in corOvlMemory.
     #
     #  An expansion factor for the bases to load into the hash table.  Each table size will hold a
     #  little more than the above number of different kmers.  The additional third in the expansion
@@ -664,8 +668,8 @@ sub configureAssembler () {
         setGlobalIfUndef("corOvlRefBlockLength",      2000000);    setGlobalIfUndef("obtOvlRefBlockLength",  15000000000);    setGlobalIfUndef("utgOvlRefBlockLength",  15000000000);   #   15 Gbp
 
         setGlobalIfUndef("corOvlMemory", "8");       setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 24);
-        setGlobalIfUndef("obtOvlMemory", "16");      setGlobalIfUndef("obtOvlThreads", "4-16");   setGlobalIfUndef("obtOvlHashBits", 24);
-        setGlobalIfUndef("utgOvlMemory", "16");      setGlobalIfUndef("utgOvlThreads", "4-16");   setGlobalIfUndef("utgOvlHashBits", 24);
+        setGlobalIfUndef("obtOvlMemory", "18");      setGlobalIfUndef("obtOvlThreads", "4-16");   setGlobalIfUndef("obtOvlHashBits", 24);
+        setGlobalIfUndef("utgOvlMemory", "18");      setGlobalIfUndef("utgOvlThreads", "4-16");   setGlobalIfUndef("utgOvlHashBits", 24);
 
         setGlobalIfUndef("corMhapMemory", "16-32");  setGlobalIfUndef("corMhapThreads", "4-16");
         setGlobalIfUndef("obtMhapMemory", "16-32");  setGlobalIfUndef("obtMhapThreads", "4-16");
@@ -679,9 +683,9 @@ sub configureAssembler () {
         setGlobalIfUndef("corOvlHashBlockLength",     2500000);    setGlobalIfUndef("obtOvlHashBlockLength",   512 * $hx);    setGlobalIfUndef("utgOvlHashBlockLength",   512 * $hx);
         setGlobalIfUndef("corOvlRefBlockLength",      2000000);    setGlobalIfUndef("obtOvlRefBlockLength",  20000000000);    setGlobalIfUndef("utgOvlRefBlockLength",  20000000000);   #   20 Gbp
 
-        setGlobalIfUndef("corOvlMemory", "8");       setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 25);
-        setGlobalIfUndef("obtOvlMemory", "24");      setGlobalIfUndef("obtOvlThreads", "4-16");   setGlobalIfUndef("obtOvlHashBits", 25);
-        setGlobalIfUndef("utgOvlMemory", "24");      setGlobalIfUndef("utgOvlThreads", "4-16");   setGlobalIfUndef("utgOvlHashBits", 25);
+        setGlobalIfUndef("corOvlMemory", "8");       setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 24);
+        setGlobalIfUndef("obtOvlMemory", "28");      setGlobalIfUndef("obtOvlThreads", "4-16");   setGlobalIfUndef("obtOvlHashBits", 25);
+        setGlobalIfUndef("utgOvlMemory", "28");      setGlobalIfUndef("utgOvlThreads", "4-16");   setGlobalIfUndef("utgOvlHashBits", 25);
 
         setGlobalIfUndef("corMhapMemory", "16-48");  setGlobalIfUndef("corMhapThreads", "4-16");
         setGlobalIfUndef("obtMhapMemory", "16-48");  setGlobalIfUndef("obtMhapThreads", "4-16");
@@ -695,9 +699,9 @@ sub configureAssembler () {
         setGlobalIfUndef("corOvlHashBlockLength",     2500000);    setGlobalIfUndef("obtOvlHashBlockLength",   512 * $hx);    setGlobalIfUndef("utgOvlHashBlockLength",   512 * $hx);
         setGlobalIfUndef("corOvlRefBlockLength",      2000000);    setGlobalIfUndef("obtOvlRefBlockLength",  30000000000);    setGlobalIfUndef("utgOvlRefBlockLength",  30000000000);   #   30 Gbp
 
-        setGlobalIfUndef("corOvlMemory", "8");       setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 25);
-        setGlobalIfUndef("obtOvlMemory", "24");      setGlobalIfUndef("obtOvlThreads", "4-16");   setGlobalIfUndef("obtOvlHashBits", 25);
-        setGlobalIfUndef("utgOvlMemory", "24");      setGlobalIfUndef("utgOvlThreads", "4-16");   setGlobalIfUndef("utgOvlHashBits", 25);
+        setGlobalIfUndef("corOvlMemory", "8");       setGlobalIfUndef("corOvlThreads", "1");      setGlobalIfUndef("corOvlHashBits", 24);
+        setGlobalIfUndef("obtOvlMemory", "28");      setGlobalIfUndef("obtOvlThreads", "4-16");   setGlobalIfUndef("obtOvlHashBits", 25);
+        setGlobalIfUndef("utgOvlMemory", "28");      setGlobalIfUndef("utgOvlThreads", "4-16");   setGlobalIfUndef("utgOvlHashBits", 25);
 
         setGlobalIfUndef("corMhapMemory", "32-64");  setGlobalIfUndef("corMhapThreads", "4-16");
         setGlobalIfUndef("obtMhapMemory", "32-64");  setGlobalIfUndef("obtMhapThreads", "4-16");
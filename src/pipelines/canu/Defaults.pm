@@ -935,6 +935,8 @@ sub setDefaults () {
         setDefault("useGrid$c", 1, "If 'true', run module $c under grid control; if 'false' run locally.");
     }
 
+    setDefault("useJobRunner", 1, "If 'true', run local jobs with jobRunner, packed by their memory and thread needs; if 'false', limit only the number of concurrent jobs; default 'true'");
+
     #####  Grid Engine configuration, for each step of the pipeline
 
     setDefault("gridOptions",           undef,  "Grid engine options applied to all jobs");
@@ -273,6 +273,54 @@ sub schedulerFinish ($$) {
 
 
 
+
+#  Run a list of jobs with jobRunner, which packs them onto the machine by
+#  their declared memory and threads, instead of by a simple process count.
+#  Each line of the list is 'memoryGB threads command'.  Per-job wall, CPU
+#  and peak memory are saved in '$nam.jobRunner.json'.
+#
+sub schedulerRunJobList ($$$$) {
+    my $dir  = shift @_;
+    my $nam  = shift @_;
+    my $list = shift @_;
+    my $con  = shift @_;   #  Concurrency limit, or 0.
+
+    my $bin       = getBinDirectory();
+    my $mem       = getGlobal("maxMemory");
+    my $thr       = getGlobal("maxThreads");
+    my $remain    = 0;
+
+    open(F, "< $dir/$list") or caExit("can't open '$dir/$list' for reading: $!", undef);
+    while (<F>) {
+        $remain++;
+    }
+    close(F);
+
+    my $startsecs = time();
+    my $diskfree  = diskSpace($dir);
+
+    print STDERR "----------------------------------------\n";
+    print STDERR "-- Starting '$nam' concurrent execution on ", scalar(localtime()), " with $diskfree GB free disk space ($remain processes; $mem GB and $thr threads)\n";
+    print STDERR "\n";
+    print STDERR "    cd $dir\n";
+
+    my $cwd = getcwd();  #  Remember where we are.
+    chdir($dir);        #  So we can root the jobs in the correct location.
+
+    my $cmd = "$bin/jobRunner -memory $mem -threads $thr";
+    $cmd   .= " -concurrency $con"   if ((defined($con)) && ($con > 0));
+    $cmd   .= " -summary ./$nam.jobRunner.json ./$list";
+
+    #  Failed jobs are found by the Check() for the stage, same as the fork loop.
+
+    system($cmd);
+
+    logFinished($dir, $startsecs);
+
+    chdir($cwd);
+}
+
+
 #
 #  File Management
 #
@@ -1374,7 +1422,12 @@ sub submitOrRunParallelJob ($$$$@) {
         exit(0);
     }
 
-    #  Standard jobs, run locally.
+    #  Standard jobs, run locally.  If jobRunner is available, it packs jobs onto the
+    #  machine by memory and threads, otherwise fall back to a count of jobs.
+
+    my $useRunner = ((getGlobal("useJobRunner") == 1) && (-x getBinDirectory() . "/jobRunner"));
+
+    open(L, "> $path/$script.jobs") or caExit("can't open '$path/$script.jobs' for writing: $!", undef)  if ($useRunner);
 
     foreach my $j (@jobs) {
         my $st;
@@ -1388,10 +1441,20 @@ sub submitOrRunParallelJob ($$$$@) {
         }
 
         for (my $i=$st; $i<=$ed; $i++) {
-            schedulerSubmit("./$script.sh $i > ./" . buildOutputName($path, $script, $i) . " 2>&1");
+            my $cmd = "./$script.sh $i > ./" . buildOutputName($path, $script, $i) . " 2>&1";
+
+            print L "$mem $thr $cmd\n"   if ( $useRunner);
+            schedulerSubmit($cmd)          if (!$useRunner);
         }
     }
 
+    if ($useRunner) {
+        close(L);
+
+        schedulerRunJobList($path, $jobType, "$script.jobs", getGlobal("${jobType}Concurrency"));
+        return;
+    }
+
     # compute limit based on # of cpus
     my $nCParallel  = getGlobal("${jobType}Concurrency");
     $nCParallel     = int(getGlobal("maxThreads") / $thr)  if ((!defined($nCParallel)) || ($nCParallel == 0));